@@ -7,6 +7,10 @@
 #include <limits>
 #include <queue>
 #include <utility>
+#include <set>
+#include <map>
+#include <chrono>
+#include <algorithm>
 
 using namespace std;
 
@@ -229,6 +233,202 @@ void findAndPrintShortestPath(CityBST &cityBST, int sourceID, int destID) {
     addHistory("Found cheapest flight path from " + sNode->name + " to " + tNode->name);
 }
 
+// ------------------- K Cheapest Paths (Yen) -------------------
+// Search budget for one K-cheapest query; the query stops early and reports
+// what it has once any of these is hit.
+const int KSP_MAX_SETTLED = 200000;        // node settles across all spur searches
+const long long KSP_TIME_LIMIT_MS = 2000;  // wall-clock limit
+const size_t KSP_MAX_CANDIDATES = 2000;    // candidates still needed that may be held
+
+struct Itinerary {
+    vector<int> path;
+    int cost;
+    int devIndex;   // index where this path left the path it was spurred from
+};
+
+bool operator<(const Itinerary &a, const Itinerary &b) {
+    if (a.cost != b.cost) return a.cost < b.cost;
+    return a.path < b.path;
+}
+
+int cheapestEdgeCost(int u, int v) {
+    int best = INF;
+    for (auto &e : adj[u])
+        if (e.to == v && e.cost < best) best = e.cost;
+    return best;
+}
+
+// Cheapest spur -> target path avoiding blockedNode, and avoiding the first
+// hops out of spur marked in blockedHop. toTarget/towardTarget come from
+// dijkstra(target) on the full graph: if the tree path is not blocked it is
+// already optimal, otherwise toTarget is an exact A* heuristic for the search.
+bool spurSearch(int spur, int target,
+                const vector<int> &toTarget, const vector<int> &towardTarget,
+                const vector<char> &blockedNode, const vector<char> &blockedHop,
+                vector<int> &spurPath, int &spurCost, int &settledBudget) {
+    spurPath.clear();
+
+    bool treeOk = !blockedHop[towardTarget[spur]];
+    for (int cur = towardTarget[spur]; treeOk && cur != -1; cur = towardTarget[cur])
+        if (blockedNode[cur]) treeOk = false;
+    if (treeOk) {
+        for (int cur = spur; cur != -1; cur = towardTarget[cur]) spurPath.push_back(cur);
+        spurCost = toTarget[spur];
+        return true;
+    }
+
+    int n = cities.size();
+    vector<int> g(n, INF), parent(n, -1);
+    typedef pair<int,int> P;
+    priority_queue<P, vector<P>, greater<P>> pq;
+    g[spur] = 0;
+    pq.push({toTarget[spur], spur});
+
+    while (!pq.empty()) {
+        auto [f, u] = pq.top(); pq.pop();
+        if (f != g[u] + toTarget[u]) continue;
+        if (--settledBudget < 0) return false;
+        if (u == target) break;
+        for (auto &edge : adj[u]) {
+            int v = edge.to;
+            if (blockedNode[v] || toTarget[v] >= INF) continue;
+            if (u == spur && blockedHop[v]) continue;
+            if (g[u] + edge.cost < g[v]) {
+                g[v] = g[u] + edge.cost;
+                parent[v] = u;
+                pq.push({g[v] + toTarget[v], v});
+            }
+        }
+    }
+    if (g[target] >= INF) return false;
+
+    spurPath = reconstructPath(target, parent);
+    spurCost = g[target];
+    return true;
+}
+
+// Up to k cheapest loopless paths from srcIndex to targetIndex, cheapest first.
+// A single cost-to-target tree is shared by every spur search, accepted paths
+// are kept in a prefix trie so each spur node finds its blocked hops in one
+// step, and a new path is only spurred from its deviation index onwards
+// (Lawler), since earlier spurs were already taken from its parent.
+vector<Itinerary> kCheapestPaths(int srcIndex, int targetIndex, int k, bool &truncated) {
+    truncated = false;
+    vector<Itinerary> accepted;
+    if (k <= 0) return accepted;
+
+    auto [toTarget, towardTarget] = dijkstra(targetIndex);
+    if (toTarget[srcIndex] >= INF) return accepted;
+
+    vector<int> first;
+    for (int cur = srcIndex; cur != -1; cur = towardTarget[cur]) first.push_back(cur);
+    accepted.push_back({first, toTarget[srcIndex], 0});
+
+    int n = cities.size();
+    vector<map<int,int>> trie(1);   // trie[node][next city] -> child node
+    set<Itinerary> pool;
+    int settledBudget = KSP_MAX_SETTLED;
+    auto started = chrono::steady_clock::now();
+
+    while ((int)accepted.size() < k) {
+        const Itinerary last = accepted.back();
+        const vector<int> &path = last.path;
+
+        int node = 0;
+        for (size_t i = 0; i + 1 < path.size(); i++) {
+            auto it = trie[node].find(path[i + 1]);
+            if (it == trie[node].end()) {
+                trie[node][path[i + 1]] = trie.size();
+                trie.push_back({});
+                node = trie.size() - 1;
+            }
+            else node = it->second;
+        }
+
+        vector<char> blockedNode(n, 0), blockedHop(n, 0);
+        int rootCost = 0;
+        node = 0;
+        for (int i = 0; i < last.devIndex; i++) {
+            blockedNode[path[i]] = 1;
+            rootCost += cheapestEdgeCost(path[i], path[i + 1]);
+            node = trie[node][path[i + 1]];
+        }
+
+        for (int i = last.devIndex; i + 1 < (int)path.size(); i++) {
+            int spur = path[i];
+            for (auto &[next, child] : trie[node]) blockedHop[next] = 1;
+
+            vector<int> spurPath;
+            int spurCost;
+            if (spurSearch(spur, targetIndex, toTarget, towardTarget,
+                           blockedNode, blockedHop, spurPath, spurCost, settledBudget)) {
+                vector<int> candidate(path.begin(), path.begin() + i);
+                candidate.insert(candidate.end(), spurPath.begin(), spurPath.end());
+                pool.insert({candidate, rootCost + spurCost, i});
+                // Only the cheapest k - accepted candidates can still be
+                // accepted; anything ranked after them is safe to drop.
+                if (pool.size() > (size_t)(k - (int)accepted.size()))
+                    pool.erase(prev(pool.end()));
+                if (pool.size() > KSP_MAX_CANDIDATES) {
+                    truncated = true;
+                    return accepted;
+                }
+            }
+
+            for (auto &[next, child] : trie[node]) blockedHop[next] = 0;
+
+            long long elapsed = chrono::duration_cast<chrono::milliseconds>(
+                chrono::steady_clock::now() - started).count();
+            if (settledBudget < 0 || elapsed > KSP_TIME_LIMIT_MS) {
+                truncated = true;
+                return accepted;
+            }
+
+            blockedNode[spur] = 1;
+            rootCost += cheapestEdgeCost(spur, path[i + 1]);
+            node = trie[node][path[i + 1]];
+        }
+
+        if (pool.empty()) break;
+        accepted.push_back(*pool.begin());
+        pool.erase(pool.begin());
+    }
+    return accepted;
+}
+
+void findAndPrintKCheapestPaths(CityBST &cityBST, int sourceID, int destID, int k) {
+    BSTNode* sNode = cityBST.find(sourceID);
+    BSTNode* tNode = cityBST.find(destID);
+
+    if(!sNode){ cout<<"Source not found.\n"; return; }
+    if(!tNode){ cout<<"Destination not found.\n"; return; }
+    if(k <= 0){ cout<<"Number of alternatives must be positive.\n"; return; }
+
+    bool truncated;
+    vector<Itinerary> routes = kCheapestPaths(sNode->index, tNode->index, k, truncated);
+
+    if(routes.empty()){
+        cout<<"No flight path exists.\n";
+        return;
+    }
+
+    cout << "Cheapest " << routes.size() << " flight path(s):\n";
+    for(size_t r=0; r<routes.size(); r++){
+        cout << r+1 << ". ";
+        for(size_t i=0; i<routes[r].path.size(); i++){
+            cout << cities[routes[r].path[i]].name;
+            if(i+1 < routes[r].path.size()) cout << " -> ";
+        }
+        cout << "  (Total cost: " << routes[r].cost << ")\n";
+    }
+    if((int)routes.size() < k)
+        cout << (truncated ? "Search budget reached; fewer alternatives shown.\n"
+                           : "No further alternatives exist.\n");
+
+    addHistory("Found " + to_string(routes.size()) + " cheapest flight paths from "
+               + sNode->name + " to " + tNode->name);
+}
+
 // ------------------- Direct Connections -------------------
 void showDirectConnections(CityBST &cityBST, int startID) {
     BSTNode* startNode = cityBST.find(startID);
@@ -270,6 +470,7 @@ int main() {
         cout<<"4. Show direct flight connections\n";
         cout<<"5. History\n";
         cout<<"6. Exit\n";
+        cout<<"7. Find K cheapest alternative flight paths\n";
         cout<<"Enter choice: ";
 
         if(!(cin >> choice)){
@@ -309,6 +510,13 @@ int main() {
             cout<<"Exiting.\n"; 
             break; 
         }
+        else if(choice==7){
+            int src,dst,k; 
+            cout<<"Source city ID: "; cin>>src; 
+            cout<<"Destination city ID: "; cin>>dst;
+            cout<<"Number of alternatives (K): "; cin>>k;
+            findAndPrintKCheapestPaths(cityBST,src,dst,k);
+        }
         else cout<<"Unknown choice.\n";
     }
 
@@ -9,6 +9,10 @@
 #include <limits>
 #include <cmath>
 #include <unordered_map>
+#include <set>
+#include <map>
+#include <chrono>
+#include <algorithm>
 
 using namespace std;
 
@@ -35,6 +39,19 @@ const float WINDOW_H = 800.f;
 const int FONT_SIZE_LABEL = 14;
 const int FONT_SIZE_NODE = 16;
 const int PATH_MARKER_RADIUS = 10;
+const int INF = numeric_limits<int>::max() / 4;
+const int ALTERNATIVE_ROUTES = 5;         // routes offered by S, cycled with N
+const int KSP_MAX_SETTLED = 200000;       // node settles across all spur searches
+const long long KSP_TIME_LIMIT_MS = 500;  // wall-clock limit per query
+const size_t KSP_MAX_CANDIDATES = 2000;   // candidates still needed that may be held
+const float GRID_CELL = 100.f;            // spatial grid cell size (world units)
+const float LABEL_MARGIN = 160.f;         // room for a name label right of a node
+const float MIN_ZOOM = 0.2f;              // camera zoom limits (world units per pixel)
+const float MAX_ZOOM = 20.f;
+const float LOD_LABEL_ZOOM = 1.5f;        // above: no weight/id labels, names for major cities only
+const float LOD_CLUSTER_ZOOM = 3.f;       // above: minor cities are aggregated into clusters
+const float CLUSTER_CELL_PX = 60.f;       // on-screen size of a cluster cell
+const int MAJOR_CITY_DEGREE = 3;          // cities with at least this many routes stay visible
 
 // ---- File loaders ----
 void loadCities(const string &filename = "cities.txt") {
@@ -116,11 +133,9 @@ void computeCircleLayout(float margin = 50.f) {
     }
 }
 
-// ---- Dijkstra shortest path (indices) ----
-vector<int> dijkstra_index(int src, int dest) {
+// ---- Dijkstra shortest path tree (indices) ----
+pair<vector<int>, vector<int>> dijkstraTree(int src) {
     int n = cities.size();
-    if (src<0 || dest<0 || src>=n || dest>=n) return {};
-    const int INF = numeric_limits<int>::max() / 4;
     vector<int> dist(n, INF), parent(n, -1);
     using P = pair<int,int>;
     priority_queue<P, vector<P>, greater<P>> pq;
@@ -129,7 +144,6 @@ vector<int> dijkstra_index(int src, int dest) {
     while(!pq.empty()){
         auto [d,u] = pq.top(); pq.pop();
         if (d != dist[u]) continue;
-        if (u==dest) break;
         for(auto [v,w] : adj[u]){
             if (dist[u] + w < dist[v]) {
                 dist[v] = dist[u] + w;
@@ -138,24 +152,259 @@ vector<int> dijkstra_index(int src, int dest) {
             }
         }
     }
-    if (dist[dest] >= INF) return {};
+    return {dist, parent};
+}
+
+// ---- K cheapest loopless paths (Yen) ----
+struct Itinerary {
     vector<int> path;
-    int cur = dest;
-    while(cur != -1){
-        path.push_back(cur);
-        cur = parent[cur];
+    int cost;
+    int devIndex; // index where this path left the path it was spurred from
+};
+
+bool operator<(const Itinerary &a, const Itinerary &b) {
+    if (a.cost != b.cost) return a.cost < b.cost;
+    return a.path < b.path;
+}
+
+int cheapestEdgeCost(int u, int v) {
+    int best = INF;
+    for (auto [to,w] : adj[u]) if (to == v && w < best) best = w;
+    return best;
+}
+
+// Cheapest spur -> target path avoiding blockedNode and the first hops marked
+// in blockedHop. The unblocked tree path is taken as is; otherwise toTarget
+// is an exact A* heuristic.
+bool spurSearch(int spur, int target,
+                const vector<int> &toTarget, const vector<int> &towardTarget,
+                const vector<char> &blockedNode, const vector<char> &blockedHop,
+                vector<int> &spurPath, int &spurCost, int &settledBudget) {
+    spurPath.clear();
+
+    bool treeOk = !blockedHop[towardTarget[spur]];
+    for (int cur = towardTarget[spur]; treeOk && cur != -1; cur = towardTarget[cur])
+        if (blockedNode[cur]) treeOk = false;
+    if (treeOk) {
+        for (int cur = spur; cur != -1; cur = towardTarget[cur]) spurPath.push_back(cur);
+        spurCost = toTarget[spur];
+        return true;
+    }
+
+    int n = cities.size();
+    vector<int> g(n, INF), parent(n, -1);
+    using P = pair<int,int>;
+    priority_queue<P, vector<P>, greater<P>> pq;
+    g[spur] = 0;
+    pq.push({toTarget[spur], spur});
+    while(!pq.empty()){
+        auto [f,u] = pq.top(); pq.pop();
+        if (f != g[u] + toTarget[u]) continue;
+        if (--settledBudget < 0) return false;
+        if (u == target) break;
+        for(auto [v,w] : adj[u]){
+            if (blockedNode[v] || toTarget[v] >= INF) continue;
+            if (u == spur && blockedHop[v]) continue;
+            if (g[u] + w < g[v]) {
+                g[v] = g[u] + w;
+                parent[v] = u;
+                pq.push({g[v] + toTarget[v], v});
+            }
+        }
+    }
+    if (g[target] >= INF) return false;
+
+    for (int cur = target; cur != -1; cur = parent[cur]) spurPath.push_back(cur);
+    reverse(spurPath.begin(), spurPath.end());
+    spurCost = g[target];
+    return true;
+}
+
+// Up to k cheapest loopless paths, cheapest first. One cost-to-target tree is
+// shared by all spur searches, accepted paths live in a prefix trie so blocked
+// hops are found per spur node in one step, and each path is only spurred from
+// its deviation index onwards. Stops early (truncated) when the budget runs out.
+vector<Itinerary> kCheapestPaths(int src, int dest, int k, bool &truncated) {
+    truncated = false;
+    vector<Itinerary> accepted;
+    int n = cities.size();
+    if (k <= 0 || src<0 || dest<0 || src>=n || dest>=n) return accepted;
+
+    auto [toTarget, towardTarget] = dijkstraTree(dest);
+    if (toTarget[src] >= INF) return accepted;
+
+    vector<int> first;
+    for (int cur = src; cur != -1; cur = towardTarget[cur]) first.push_back(cur);
+    accepted.push_back({first, toTarget[src], 0});
+
+    vector<map<int,int>> trie(1); // trie[node][next city] -> child node
+    set<Itinerary> pool;
+    int settledBudget = KSP_MAX_SETTLED;
+    auto started = chrono::steady_clock::now();
+
+    while ((int)accepted.size() < k) {
+        const Itinerary last = accepted.back();
+        const vector<int> &path = last.path;
+
+        int node = 0;
+        for (size_t i=0;i+1<path.size();++i){
+            auto it = trie[node].find(path[i+1]);
+            if (it == trie[node].end()) {
+                trie[node][path[i+1]] = trie.size();
+                trie.push_back({});
+                node = trie.size() - 1;
+            }
+            else node = it->second;
+        }
+
+        vector<char> blockedNode(n, 0), blockedHop(n, 0);
+        int rootCost = 0;
+        node = 0;
+        for (int i=0;i<last.devIndex;++i){
+            blockedNode[path[i]] = 1;
+            rootCost += cheapestEdgeCost(path[i], path[i+1]);
+            node = trie[node][path[i+1]];
+        }
+
+        for (int i=last.devIndex;i+1<(int)path.size();++i){
+            int spur = path[i];
+            for (auto &[next, child] : trie[node]) blockedHop[next] = 1;
+
+            vector<int> spurPath;
+            int spurCost;
+            if (spurSearch(spur, dest, toTarget, towardTarget,
+                           blockedNode, blockedHop, spurPath, spurCost, settledBudget)) {
+                vector<int> candidate(path.begin(), path.begin() + i);
+                candidate.insert(candidate.end(), spurPath.begin(), spurPath.end());
+                pool.insert({candidate, rootCost + spurCost, i});
+                // Only the cheapest k - accepted candidates can still be
+                // accepted; anything ranked after them is safe to drop.
+                if (pool.size() > (size_t)(k - (int)accepted.size()))
+                    pool.erase(prev(pool.end()));
+                if (pool.size() > KSP_MAX_CANDIDATES) {
+                    truncated = true;
+                    return accepted;
+                }
+            }
+
+            for (auto &[next, child] : trie[node]) blockedHop[next] = 0;
+
+            long long elapsed = chrono::duration_cast<chrono::milliseconds>(
+                chrono::steady_clock::now() - started).count();
+            if (settledBudget < 0 || elapsed > KSP_TIME_LIMIT_MS) {
+                truncated = true;
+                return accepted;
+            }
+
+            blockedNode[spur] = 1;
+            rootCost += cheapestEdgeCost(spur, path[i+1]);
+            node = trie[node][path[i+1]];
+        }
+
+        if (pool.empty()) break;
+        accepted.push_back(*pool.begin());
+        pool.erase(pool.begin());
+    }
+    return accepted;
+}
+
+// ---- Spatial grid (culling & picking) ----
+// Uniform grid over city centres. Each city sits in one cell; each edge is
+// listed in every cell its bounding box touches, so a view query only visits
+// the cells on screen. Rebuilt whenever the layout changes.
+struct SpatialGrid {
+    float originX = 0.f, originY = 0.f;
+    int cols = 0, rows = 0;
+    vector<vector<int>> nodeCells;
+    vector<vector<int>> edgeCells;
+    vector<int> edgeStamp; // last query that reported each edge
+    int query = 0;
+};
+
+SpatialGrid grid;
+
+sf::Vector2f cityCenter(int i) {
+    return cities[i].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
+}
+
+int gridCol(float x) { return max(0, min(grid.cols-1, (int)floor((x - grid.originX) / GRID_CELL))); }
+int gridRow(float y) { return max(0, min(grid.rows-1, (int)floor((y - grid.originY) / GRID_CELL))); }
+
+void buildSpatialGrid() {
+    grid = SpatialGrid();
+    if (cities.empty()) return;
+    float minX = cityCenter(0).x, maxX = minX, minY = cityCenter(0).y, maxY = minY;
+    for (int i=1;i<(int)cities.size();++i){
+        sf::Vector2f c = cityCenter(i);
+        minX = min(minX, c.x); maxX = max(maxX, c.x);
+        minY = min(minY, c.y); maxY = max(maxY, c.y);
+    }
+    grid.originX = minX;
+    grid.originY = minY;
+    grid.cols = (int)((maxX - minX) / GRID_CELL) + 1;
+    grid.rows = (int)((maxY - minY) / GRID_CELL) + 1;
+    grid.nodeCells.assign(grid.cols * grid.rows, {});
+    grid.edgeCells.assign(grid.cols * grid.rows, {});
+    grid.edgeStamp.assign(edges.size(), -1);
+
+    for (int i=0;i<(int)cities.size();++i){
+        sf::Vector2f c = cityCenter(i);
+        grid.nodeCells[gridRow(c.y) * grid.cols + gridCol(c.x)].push_back(i);
+    }
+    for (int e=0;e<(int)edges.size();++e){
+        sf::Vector2f a = cityCenter(edges[e].from), b = cityCenter(edges[e].to);
+        int c0 = gridCol(min(a.x,b.x)), c1 = gridCol(max(a.x,b.x));
+        int r0 = gridRow(min(a.y,b.y)), r1 = gridRow(max(a.y,b.y));
+        for (int r=r0;r<=r1;++r)
+            for (int c=c0;c<=c1;++c) grid.edgeCells[r * grid.cols + c].push_back(e);
+    }
+}
+
+// Cities and edges that may be visible inside area (world coordinates).
+// Cities are padded by their radius and label so partly visible ones are kept.
+void queryVisible(const sf::FloatRect &area, float labelScale, vector<int> &nodesOut, vector<int> &edgesOut) {
+    nodesOut.clear();
+    edgesOut.clear();
+    if (grid.cols == 0) return;
+    float pad = NODE_RADIUS * SELECT_SCALE;
+    float padY = max(pad, FONT_SIZE_NODE * labelScale);
+    float left = area.left - LABEL_MARGIN*labelScale, right = area.left + area.width + pad;
+    float top = area.top - padY, bottom = area.top + area.height + padY;
+    int c0 = gridCol(left), c1 = gridCol(right);
+    int r0 = gridRow(top), r1 = gridRow(bottom);
+    grid.query++;
+
+    for (int r=r0;r<=r1;++r){
+        for (int c=c0;c<=c1;++c){
+            for (int i : grid.nodeCells[r * grid.cols + c]){
+                sf::Vector2f p = cityCenter(i);
+                if (p.x >= left && p.x <= right && p.y >= top && p.y <= bottom) nodesOut.push_back(i);
+            }
+            for (int e : grid.edgeCells[r * grid.cols + c]){
+                if (grid.edgeStamp[e] == grid.query) continue;
+                grid.edgeStamp[e] = grid.query;
+                sf::Vector2f a = cityCenter(edges[e].from), b = cityCenter(edges[e].to);
+                if (max(a.x,b.x) < area.left || min(a.x,b.x) > area.left + area.width) continue;
+                if (max(a.y,b.y) < area.top || min(a.y,b.y) > area.top + area.height) continue;
+                edgesOut.push_back(e);
+            }
+        }
     }
-    reverse(path.begin(), path.end());
-    return path;
 }
 
 // ---- Utilities ----
 int findCityAtPosition(const sf::Vector2f &mousePos) {
-    for (int i=0;i<(int)cities.size();++i){
-        sf::Vector2f center = cities[i].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
-        float dx = mousePos.x - center.x;
-        float dy = mousePos.y - center.y;
-        if (sqrt(dx*dx + dy*dy) <= NODE_RADIUS + 4.f) return i;
+    if (grid.cols == 0) return -1;
+    int c = gridCol(mousePos.x), r = gridRow(mousePos.y);
+    for (int rr=max(0,r-1);rr<=min(grid.rows-1,r+1);++rr){
+        for (int cc=max(0,c-1);cc<=min(grid.cols-1,c+1);++cc){
+            for (int i : grid.nodeCells[rr * grid.cols + cc]){
+                sf::Vector2f center = cityCenter(i);
+                float dx = mousePos.x - center.x;
+                float dy = mousePos.y - center.y;
+                if (sqrt(dx*dx + dy*dy) <= NODE_RADIUS + 4.f) return i;
+            }
+        }
     }
     return -1;
 }
@@ -183,10 +432,19 @@ int main() {
     }
 
     computeCircleLayout();
+    buildSpatialGrid();
 
     sf::RenderWindow window(sf::VideoMode((unsigned)WINDOW_W,(unsigned)WINDOW_H), "Cities Graph");
     window.setFramerateLimit(60);
 
+    // Camera: wheel zooms about the cursor, middle-drag or arrow keys pan, Home resets.
+    // The HUD view stays in pixel coordinates.
+    sf::View camera(sf::FloatRect(0.f,0.f,WINDOW_W,WINDOW_H));
+    sf::View hudView(sf::FloatRect(0.f,0.f,WINDOW_W,WINDOW_H));
+    float zoom = 1.f; // world units per pixel
+    bool panning = false, panMoved = false;
+    sf::Vector2i panLast;
+
     vector<sf::CircleShape> cityShapes;
     cityShapes.reserve(cities.size());
     for (auto &c: cities) {
@@ -214,43 +472,110 @@ int main() {
     bool pathAnimating = false;
     float highlightPulse = 0.f;
 
-    auto drawEdge = [&](sf::RenderWindow &win, const Edge &e, sf::Color col, float thickness=2.f) {
-        sf::Vector2f p1 = cities[e.from].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
-        sf::Vector2f p2 = cities[e.to].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
-        sf::Vertex line[] = { sf::Vertex(p1, col), sf::Vertex(p2, col) };
-        win.draw(line, 2, sf::Lines);
+    vector<Itinerary> alternatives;
+    int currentAlternative = 0;
+    bool alternativesTruncated = false;
+    vector<char> onPath(cities.size(), 0);
+
+    auto showAlternative = [&]() {
+        for(int i : shortestPath) onPath[i] = 0;
+        shortestPath.clear();
+        segmentLengths.clear();
+        pathAnimating = false;
+        if (alternatives.empty()) return;
+        shortestPath = alternatives[currentAlternative].path;
+        for(int i : shortestPath) onPath[i] = 1;
+        segmentLengths = computeSegmentLengths(shortestPath);
+        pathTotalLength = 0.f;
+        for(float L: segmentLengths) pathTotalLength += L;
+        pathTravelled = 0.f;
+        animClock.restart();
+        pathAnimating = true;
+    };
+
+    auto zoomAt = [&](sf::Vector2i pixel, float factor) {
+        float next = max(MIN_ZOOM, min(MAX_ZOOM, zoom * factor));
+        sf::Vector2f before = window.mapPixelToCoords(pixel, camera);
+        camera.zoom(next / zoom);
+        zoom = next;
+        sf::Vector2f after = window.mapPixelToCoords(pixel, camera);
+        camera.move(before - after);
     };
 
+    vector<int> visibleNodes, visibleEdges;
+    sf::VertexArray edgeLines(sf::Lines);
+    vector<int> clusterOf(cities.size(), -1);   // cluster of each city this frame, -1 if drawn alone
+    vector<vector<int>> clusterMembers;
+    vector<sf::Vector2f> clusterCentroid;
+    vector<int> soloNodes;
+
     while(window.isOpen()){
         sf::Event event;
         while(window.pollEvent(event)){
             if (event.type == sf::Event::Closed) window.close();
+            if (event.type == sf::Event::Resized) {
+                float w = (float)event.size.width, h = (float)event.size.height;
+                camera.setSize(w*zoom, h*zoom);
+                hudView.reset(sf::FloatRect(0.f,0.f,w,h));
+            }
+            if (event.type == sf::Event::MouseWheelScrolled && event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+                zoomAt({event.mouseWheelScroll.x, event.mouseWheelScroll.y}, event.mouseWheelScroll.delta > 0 ? 0.8f : 1.25f);
+            }
             if (event.type == sf::Event::MouseButtonPressed) {
-                sf::Vector2f mp = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-                int idx = findCityAtPosition(mp);
+                sf::Vector2i pixel(event.mouseButton.x, event.mouseButton.y);
+                int idx = findCityAtPosition(window.mapPixelToCoords(pixel, camera));
                 if (idx != -1) {
                     if (event.mouseButton.button == sf::Mouse::Left) selectedSource = idx;
                     else if (event.mouseButton.button == sf::Mouse::Right) selectedDest = idx;
                 }
-                if (event.mouseButton.button == sf::Mouse::Middle) selectedSource = selectedDest = -1;
+                if (event.mouseButton.button == sf::Mouse::Middle) {
+                    panning = true;
+                    panMoved = false;
+                    panLast = pixel;
+                }
+            }
+            if (event.type == sf::Event::MouseMoved && panning) {
+                sf::Vector2i pixel(event.mouseMove.x, event.mouseMove.y);
+                sf::Vector2i d = pixel - panLast;
+                if (abs(d.x) + abs(d.y) > 3 || panMoved) {
+                    camera.move(-d.x*zoom, -d.y*zoom);
+                    panLast = pixel;
+                    panMoved = true;
+                }
+            }
+            if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Middle) {
+                // A middle click without dragging still clears the selection
+                if (panning && !panMoved) selectedSource = selectedDest = -1;
+                panning = false;
             }
             if (event.type == sf::Event::KeyPressed) {
+                sf::Vector2f step = camera.getSize() * 0.1f;
+                if (event.key.code == sf::Keyboard::Left) camera.move(-step.x, 0.f);
+                if (event.key.code == sf::Keyboard::Right) camera.move(step.x, 0.f);
+                if (event.key.code == sf::Keyboard::Up) camera.move(0.f, -step.y);
+                if (event.key.code == sf::Keyboard::Down) camera.move(0.f, step.y);
+                if (event.key.code == sf::Keyboard::Home) {
+                    sf::Vector2u size = window.getSize();
+                    zoom = 1.f;
+                    camera.setSize((float)size.x, (float)size.y);
+                    camera.setCenter(WINDOW_W/2.f, WINDOW_H/2.f);
+                }
                 if (event.key.code == sf::Keyboard::S) {
                     int srcIdx = (selectedSource!=-1)?selectedSource:0;
                     int dstIdx = (selectedDest!=-1)?selectedDest:(int)cities.size()-1;
-                    shortestPath = dijkstra_index(srcIdx, dstIdx);
-                    if(!shortestPath.empty()){
-                        segmentLengths = computeSegmentLengths(shortestPath);
-                        pathTotalLength = 0.f;
-                        for(float L: segmentLengths) pathTotalLength += L;
-                        pathTravelled = 0.f;
-                        animClock.restart();
-                        pathAnimating = true;
-                    }
+                    alternatives = kCheapestPaths(srcIdx, dstIdx, ALTERNATIVE_ROUTES, alternativesTruncated);
+                    currentAlternative = 0;
+                    showAlternative();
+                }
+                if (event.key.code == sf::Keyboard::N && !alternatives.empty()) {
+                    currentAlternative = (currentAlternative + 1) % (int)alternatives.size();
+                    showAlternative();
                 }
                 if (event.key.code == sf::Keyboard::R) {
                     computeCircleLayout();
+                    buildSpatialGrid();
                     for (int i=0;i<(int)cityShapes.size();++i) cityShapes[i].setPosition(cities[i].position);
+                    if (!shortestPath.empty()) showAlternative();
                 }
             }
         }
@@ -263,23 +588,80 @@ int main() {
         } else highlightPulse = 0.f;
 
         window.clear(sf::Color::White);
+        window.setView(camera);
 
-        // Draw normal edges with weights
-        for (auto &e: edges) {
-            drawEdge(window, e, sf::Color::Black, 2.f);
-
-            sf::Vector2f p1 = cities[e.from].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
-            sf::Vector2f p2 = cities[e.to].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
-            sf::Vector2f mid = (p1 + p2) * 0.5f;
+        // Only what the grid reports inside the camera is submitted
+        sf::Vector2f viewSize = camera.getSize();
+        sf::FloatRect viewRect(camera.getCenter() - viewSize/2.f, viewSize);
+        float labelScale = max(1.f, zoom);
+        queryVisible(viewRect, labelScale, visibleNodes, visibleEdges);
 
-            sf::Vector2f dir = p2 - p1;
-            float length = sqrt(dir.x*dir.x + dir.y*dir.y);
-            if(length != 0.f){
-                sf::Vector2f offset(-dir.y/length * 15.f, dir.x/length * 15.f);
-                mid += offset;
+        // Zoomed out, minor cities sharing a screen cell are merged into a
+        // cluster; major, selected, hovered and on-route cities stay alone.
+        sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window), camera);
+        int hoverIdx = findCityAtPosition(mousePos);
+        for(auto &members : clusterMembers)
+            for(int i : members) clusterOf[i] = -1;
+        clusterMembers.clear();
+        clusterCentroid.clear();
+        soloNodes.clear();
+
+        if(zoom > LOD_CLUSTER_ZOOM){
+            float clusterCell = CLUSTER_CELL_PX * zoom;
+            map<pair<int,int>, vector<int>> cells;
+            for(int i : visibleNodes){
+                bool pinned = i==selectedSource || i==selectedDest || i==hoverIdx || onPath[i];
+                if(pinned || (int)adj[i].size() >= MAJOR_CITY_DEGREE){ soloNodes.push_back(i); continue; }
+                sf::Vector2f c = cityCenter(i);
+                cells[{(int)floor(c.x/clusterCell), (int)floor(c.y/clusterCell)}].push_back(i);
+            }
+            for(auto &[cell, members] : cells){
+                if(members.size() == 1){ soloNodes.push_back(members[0]); continue; }
+                sf::Vector2f centroid(0.f,0.f);
+                for(int i : members){ centroid += cityCenter(i); clusterOf[i] = clusterMembers.size(); }
+                centroid /= (float)members.size();
+                clusterMembers.push_back(members);
+                clusterCentroid.push_back(centroid);
+            }
+        }
+        else soloNodes = visibleNodes;
+
+        // Draw normal edges in one batch; weights only when zoomed in.
+        // Edges inside a cluster are skipped and edges into one end at its
+        // centroid, with duplicate cluster links drawn once.
+        edgeLines.clear();
+        set<pair<int,int>> clusterLinks;
+        for (int ei: visibleEdges) {
+            int a = edges[ei].from, b = edges[ei].to;
+            int ca = clusterOf[a], cb = clusterOf[b];
+            if (ca != -1 && ca == cb) continue;
+            if (ca != -1 || cb != -1) {
+                // key endpoints: city i -> i, cluster c -> -(c+1)
+                int ka = (ca != -1) ? -(ca+1) : a;
+                int kb = (cb != -1) ? -(cb+1) : b;
+                if (!clusterLinks.insert({min(ka,kb), max(ka,kb)}).second) continue;
             }
+            sf::Vector2f pa = (ca != -1) ? clusterCentroid[ca] : cityCenter(a);
+            sf::Vector2f pb = (cb != -1) ? clusterCentroid[cb] : cityCenter(b);
+            edgeLines.append(sf::Vertex(pa, sf::Color::Black));
+            edgeLines.append(sf::Vertex(pb, sf::Color::Black));
+        }
+        window.draw(edgeLines);
+
+        if(fontLoaded && zoom <= LOD_LABEL_ZOOM){
+            for (int ei: visibleEdges) {
+                const Edge &e = edges[ei];
+                sf::Vector2f p1 = cityCenter(e.from);
+                sf::Vector2f p2 = cityCenter(e.to);
+                sf::Vector2f mid = (p1 + p2) * 0.5f;
+
+                sf::Vector2f dir = p2 - p1;
+                float length = sqrt(dir.x*dir.x + dir.y*dir.y);
+                if(length != 0.f){
+                    sf::Vector2f offset(-dir.y/length * 15.f, dir.x/length * 15.f);
+                    mid += offset;
+                }
 
-            if(fontLoaded){
                 sf::Text wt(to_string(e.weight), font, FONT_SIZE_LABEL);
                 wt.setFillColor(sf::Color::Red);
                 wt.setOrigin(wt.getLocalBounds().width/2.f, wt.getLocalBounds().height/2.f);
@@ -302,15 +684,15 @@ int main() {
                 sf::Vector2f B = cities[shortestPath[i+1]].position + sf::Vector2f(NODE_RADIUS, NODE_RADIUS);
 
                 sf::Color col;
-                float thickness = 2.f;
+                float thickness = 2.f*labelScale;
                 if(i < segIndex){ 
                     col = sf::Color(0,150,0); // dark green
-                    thickness = 4.f;
+                    thickness = 4.f*labelScale;
                 }
                 else if(i == segIndex){
                     float t = (segmentLengths[i]==0)?0:(remaining/segmentLengths[i]);
                     col = sf::Color(0,(sf::Uint8)(150*t),0);
-                    thickness = 4.f;
+                    thickness = 4.f*labelScale;
                 } 
                 else col = sf::Color::Black;
 
@@ -338,17 +720,16 @@ int main() {
                 float t = (segmentLengths[segIndex]==0)?0:(remaining/segmentLengths[segIndex]);
                 pos = A + (B-A)*t;
             }
-            sf::CircleShape marker(PATH_MARKER_RADIUS);
-            marker.setOrigin(PATH_MARKER_RADIUS,PATH_MARKER_RADIUS);
+            float markerRadius = PATH_MARKER_RADIUS*labelScale;
+            sf::CircleShape marker(markerRadius);
+            marker.setOrigin(markerRadius,markerRadius);
             marker.setPosition(pos);
             marker.setFillColor(sf::Color::Yellow);
             window.draw(marker);
         }
 
-        // Draw nodes
-        sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-        int hoverIdx = findCityAtPosition(mousePos);
-        for(int i=0;i<(int)cities.size();++i){
+        // Draw nodes. Zoomed out, only major cities keep their names.
+        auto drawCity = [&](int i, bool major) {
             auto &shape = cityShapes[i];
             shape.setFillColor(sf::Color(173,216,230));
             float scale = 1.f;
@@ -359,21 +740,65 @@ int main() {
             else if(i==selectedDest) shape.setOutlineColor(sf::Color::Red);
             else shape.setOutlineColor(sf::Color::Black);
             shape.setOrigin(NODE_RADIUS,NODE_RADIUS);
-            sf::Vector2f center=cities[i].position+sf::Vector2f(NODE_RADIUS,NODE_RADIUS);
+            sf::Vector2f center=cityCenter(i);
             shape.setPosition(center);
             window.draw(shape);
 
-            if(fontLoaded){
+            if(!fontLoaded) return;
+            if(zoom <= LOD_LABEL_ZOOM || major){
                 sf::Text tName(cities[i].name,font,FONT_SIZE_NODE);
                 tName.setFillColor(sf::Color::Black);
-                tName.setPosition(center+sf::Vector2f(NODE_RADIUS*0.8f,-8.f));
+                tName.setScale(labelScale,labelScale);
+                tName.setPosition(center+sf::Vector2f(NODE_RADIUS*0.8f,-8.f*labelScale));
                 window.draw(tName);
-
+            }
+            if(zoom <= LOD_LABEL_ZOOM){
                 sf::Text tId(to_string(cities[i].id),font,12);
                 tId.setFillColor(sf::Color::Black);
                 tId.setPosition(center-sf::Vector2f(6.f,6.f));
                 window.draw(tId);
             }
+        };
+
+        for(int i : soloNodes){
+            bool pinned = i==selectedSource || i==selectedDest || i==hoverIdx || onPath[i];
+            drawCity(i, pinned || (int)adj[i].size() >= MAJOR_CITY_DEGREE);
+        }
+
+        for(size_t c=0;c<clusterMembers.size();++c){
+            const vector<int> &members = clusterMembers[c];
+            sf::Vector2f centroid = clusterCentroid[c];
+
+            float radius = (8.f + 2.f*sqrt((float)members.size())) * zoom;
+            sf::CircleShape blob(radius);
+            blob.setOrigin(radius,radius);
+            blob.setPosition(centroid);
+            blob.setFillColor(sf::Color(173,216,230));
+            blob.setOutlineThickness(2.f*zoom);
+            blob.setOutlineColor(sf::Color(90,90,90));
+            window.draw(blob);
+
+            if(fontLoaded){
+                sf::Text tCount(to_string(members.size()),font,12);
+                tCount.setFillColor(sf::Color::Black);
+                tCount.setScale(zoom,zoom);
+                tCount.setOrigin(tCount.getLocalBounds().width/2.f, tCount.getLocalBounds().height/2.f);
+                tCount.setPosition(centroid);
+                window.draw(tCount);
+            }
+        }
+
+        // Route caption: which alternative is shown and its cost
+        window.setView(hudView);
+        if(fontLoaded && !alternatives.empty()){
+            string caption = "Route " + to_string(currentAlternative+1) + "/" + to_string(alternatives.size())
+                           + "  Cost: " + to_string(alternatives[currentAlternative].cost);
+            if(alternatives.size() > 1) caption += "  (N: next)";
+            if(alternativesTruncated) caption += "  [search budget reached]";
+            sf::Text tRoute(caption,font,FONT_SIZE_NODE);
+            tRoute.setFillColor(sf::Color::Black);
+            tRoute.setPosition(10.f,10.f);
+            window.draw(tRoute);
         }
 
         window.display();